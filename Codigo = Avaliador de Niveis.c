@@ -0,0 +1,380 @@
+/* ======================== Documentação do Projeto ======================== */
+/**
+ * @file avaliador.c
+ * @brief Avaliador de dificuldade dos padrões do Jogo de Memória.
+ * @date 10/2026
+ * @version 0.1
+ * @license GPL
+ *
+ * @note Descrição:
+ * Programa offline que sorteia muitos padrões candidatos para cada fase,
+ * calcula a dificuldade de cada um e grava os níveis calibrados no arquivo
+ * niveis.bin (formato em niveis.h). As fases são distribuídas entre todas
+ * as threads disponíveis.
+ *
+ * Compilação: gcc "Codigo = Avaliador de Niveis.c" -o avaliador -O2 -pthread
+ * Uso: ./avaliador [arquivo_de_saida] [semente]
+ * A mesma semente sempre gera o mesmo niveis.bin (padrão: SEMENTE_PADRAO).
+ */
+
+/* ====================== Diretivas de Processamento ====================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "niveis.h"
+
+#define CANDIDATOS_POR_FASE 200000
+#define MAX_THREADS 64
+#define SEMENTE_PADRAO 20250601ULL
+
+/* ========================= Protótipos de Funções ========================= */
+
+unsigned long long xorshift64(unsigned long long *semente);
+unsigned long long sortear_padrao(int fase, int tamanho, unsigned long long *semente);
+double avaliar_padrao(unsigned long long padrao, int tamanho);
+int contar_componentes(unsigned long long padrao, int tamanho, int *isolados);
+int contar_simetrias(unsigned long long padrao, int tamanho);
+int comparar_candidatos(const void *a, const void *b);
+void calibrar_fase(int fase, unsigned long long *semente);
+void *trabalhar(void *argumento);
+int gravar_niveis(const char *caminho);
+
+/* =============================== Registros =============================== */
+/**
+ * @brief Padrão candidato junto com a sua dificuldade calculada.
+ */
+
+typedef struct candidato_de_padrao
+{
+    unsigned long long padrao;
+    double dificuldade;
+} candidato;
+
+/* =========================== Variáveis Globais =========================== */
+
+unsigned long long niveis[NIVEIS_QTD_FASES][NIVEIS_BALDES][NIVEIS_PADROES_POR_BALDE];
+atomic_int proxima_fase = NIVEIS_FASE_MIN; // Fila de trabalho compartilhada pelas threads.
+unsigned long long semente_base;
+
+/* =========================== Função Principal ============================ */
+
+int main(int argc, char *argv[])
+{
+    const char *caminho = (argc > 1)? argv[1] : NIVEIS_ARQUIVO;
+    pthread_t threads[MAX_THREADS];
+    long qtd_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    qtd_threads = (qtd_threads < 1)? 1 : (qtd_threads > MAX_THREADS)? MAX_THREADS : qtd_threads;
+    semente_base = (argc > 2)? strtoull(argv[2], NULL, 10) : SEMENTE_PADRAO;
+
+    long criadas = 0;
+    for (long i = 0; i < qtd_threads; i++)
+    {
+        if (pthread_create(&threads[criadas], NULL, trabalhar, NULL) == 0)
+        {
+            criadas++;
+        }
+    }
+    printf("Avaliando fases %d a %d com %ld threads (semente %llu)...\n",
+           NIVEIS_FASE_MIN, NIVEIS_FASE_MAX, (criadas > 0)? criadas : 1, semente_base);
+    if (criadas == 0)
+    {
+        trabalhar(NULL); // Nenhuma thread criada: avalia tudo na thread principal.
+    }
+    for (long i = 0; i < criadas; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    if (!gravar_niveis(caminho))
+    {
+        fprintf(stderr, "Erro ao gravar %s\n", caminho);
+        return 1;
+    }
+    printf("Niveis gravados em %s\n", caminho);
+    return 0;
+}
+
+/* ======================= Desenvolvimento de Funções ====================== */
+
+/**
+ * @brief Gerador xorshift64, com estado próprio para cada thread.
+ *
+ * @param semente Estado do gerador (atualizado a cada chamada)
+ * @return Próximo número pseudoaleatório de 64 bits
+ */
+unsigned long long xorshift64(unsigned long long *semente)
+{
+    unsigned long long x = *semente;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *semente = x;
+    return x;
+}
+
+/**
+ * @brief Sorteia um padrão com exatamente "fase" quadrados azuis.
+ *
+ * @param fase Quantidade de quadrados azuis
+ * @param tamanho Dimensão do tabuleiro
+ * @param semente Estado do gerador da thread
+ * @return Máscara de bits do padrão
+ */
+unsigned long long sortear_padrao(int fase, int tamanho, unsigned long long *semente)
+{
+    unsigned long long padrao = 0;
+    int total = tamanho * tamanho;
+    for (int i = 0; i < fase;)
+    {
+        int celula = xorshift64(semente) % total;
+        if (!(padrao & (1ULL << celula)))
+        {
+            padrao |= 1ULL << celula;
+            i++;
+        }
+    }
+    return padrao;
+}
+
+/**
+ * @brief Conta os grupos de quadrados vizinhos (na horizontal ou vertical).
+ *
+ * @param padrao Máscara de bits do padrão
+ * @param tamanho Dimensão do tabuleiro
+ * @param isolados Recebe a quantidade de quadrados sem nenhum vizinho
+ * @return Número de grupos
+ */
+int contar_componentes(unsigned long long padrao, int tamanho, int *isolados)
+{
+    unsigned long long visitados = 0;
+    int pilha[64];
+    int componentes = 0;
+    *isolados = 0;
+
+    for (int inicio = 0; inicio < tamanho * tamanho; inicio++)
+    {
+        if (!(padrao & (1ULL << inicio)) || (visitados & (1ULL << inicio)))
+        {
+            continue;
+        }
+        int topo = 0, tamanho_do_grupo = 0;
+        pilha[topo++] = inicio;
+        visitados |= 1ULL << inicio;
+        while (topo > 0)
+        {
+            int celula = pilha[--topo];
+            int linha = celula / tamanho, coluna = celula % tamanho;
+            int vizinhos[4] = {
+                (linha > 0)? celula - tamanho : -1,
+                (linha < tamanho - 1)? celula + tamanho : -1,
+                (coluna > 0)? celula - 1 : -1,
+                (coluna < tamanho - 1)? celula + 1 : -1
+            };
+            tamanho_do_grupo++;
+            for (int v = 0; v < 4; v++)
+            {
+                if (vizinhos[v] >= 0 && (padrao & (1ULL << vizinhos[v])) && !(visitados & (1ULL << vizinhos[v])))
+                {
+                    visitados |= 1ULL << vizinhos[v];
+                    pilha[topo++] = vizinhos[v];
+                }
+            }
+        }
+        if (tamanho_do_grupo == 1)
+        {
+            (*isolados)++;
+        }
+        componentes++;
+    }
+    return componentes;
+}
+
+/**
+ * @brief Conta as simetrias do padrão: espelho horizontal, espelho vertical,
+ * diagonal principal e rotação de 180 graus.
+ *
+ * @return Número de simetrias (0 a 4)
+ */
+int contar_simetrias(unsigned long long padrao, int tamanho)
+{
+    unsigned long long horizontal = 0, vertical = 0, diagonal = 0, rotacao = 0;
+    for (int linha = 0; linha < tamanho; linha++)
+    {
+        for (int coluna = 0; coluna < tamanho; coluna++)
+        {
+            if (padrao & (1ULL << (linha * tamanho + coluna)))
+            {
+                horizontal |= 1ULL << (linha * tamanho + (tamanho - 1 - coluna));
+                vertical |= 1ULL << ((tamanho - 1 - linha) * tamanho + coluna);
+                diagonal |= 1ULL << (coluna * tamanho + linha);
+                rotacao |= 1ULL << ((tamanho - 1 - linha) * tamanho + (tamanho - 1 - coluna));
+            }
+        }
+    }
+    return (horizontal == padrao) + (vertical == padrao) + (diagonal == padrao) + (rotacao == padrao);
+}
+
+/**
+ * @brief Modelo de dificuldade de um padrão (quanto maior, mais difícil).
+ *
+ * @note Critérios:
+ * - Cada grupo separado é mais um item para memorizar; quadrados isolados pesam mais.
+ * - Padrões simétricos são mais fáceis de lembrar.
+ * - Quadrados nos cantos e bordas servem de referência e facilitam.
+ */
+double avaliar_padrao(unsigned long long padrao, int tamanho)
+{
+    int isolados, cantos = 0, bordas = 0;
+    int componentes = contar_componentes(padrao, tamanho, &isolados);
+    int simetrias = contar_simetrias(padrao, tamanho);
+
+    for (int linha = 0; linha < tamanho; linha++)
+    {
+        for (int coluna = 0; coluna < tamanho; coluna++)
+        {
+            if (!(padrao & (1ULL << (linha * tamanho + coluna))))
+            {
+                continue;
+            }
+            int na_linha_da_borda = (linha == 0 || linha == tamanho - 1);
+            int na_coluna_da_borda = (coluna == 0 || coluna == tamanho - 1);
+            if (na_linha_da_borda && na_coluna_da_borda)
+            {
+                cantos++;
+            }
+            else if (na_linha_da_borda || na_coluna_da_borda)
+            {
+                bordas++;
+            }
+        }
+    }
+    return componentes * 1.0 + isolados * 0.5 - simetrias * 0.75 - cantos * 0.3 - bordas * 0.15;
+}
+
+/**
+ * @brief Ordena candidatos pela dificuldade e, no empate, pelo padrão
+ * (deixa padrões repetidos lado a lado).
+ */
+int comparar_candidatos(const void *a, const void *b)
+{
+    const candidato *x = a, *y = b;
+    if (x->dificuldade != y->dificuldade)
+    {
+        return (x->dificuldade < y->dificuldade)? -1 : 1;
+    }
+    return (x->padrao < y->padrao)? -1 : (x->padrao > y->padrao);
+}
+
+/**
+ * @brief Avalia os candidatos de uma fase e preenche os seus baldes.
+ *
+ * @note Os candidatos ordenados são divididos em NIVEIS_BALDES partes iguais
+ * (do mais fácil ao mais difícil) e cada balde recebe padrões espaçados
+ * uniformemente dentro da sua parte.
+ */
+void calibrar_fase(int fase, unsigned long long *semente)
+{
+    int tamanho = definir_tamanho(fase);
+    int unicos = 0;
+    candidato *candidatos = malloc(CANDIDATOS_POR_FASE * sizeof(candidato));
+    if (candidatos == NULL)
+    {
+        fprintf(stderr, "Sem memoria para a fase %d\n", fase);
+        exit(1);
+    }
+
+    for (int i = 0; i < CANDIDATOS_POR_FASE; i++)
+    {
+        candidatos[i].padrao = sortear_padrao(fase, tamanho, semente);
+        candidatos[i].dificuldade = avaliar_padrao(candidatos[i].padrao, tamanho);
+    }
+    qsort(candidatos, CANDIDATOS_POR_FASE, sizeof(candidato), comparar_candidatos);
+
+    // Remove padrões repetidos.
+    for (int i = 0; i < CANDIDATOS_POR_FASE; i++)
+    {
+        if (unicos == 0 || candidatos[i].padrao != candidatos[unicos - 1].padrao)
+        {
+            candidatos[unicos++] = candidatos[i];
+        }
+    }
+
+    for (int balde = 0; balde < NIVEIS_BALDES; balde++)
+    {
+        int inicio = unicos * balde / NIVEIS_BALDES;
+        int fim = unicos * (balde + 1) / NIVEIS_BALDES;
+        int largura = (fim > inicio)? fim - inicio : 1;
+        for (int p = 0; p < NIVEIS_PADROES_POR_BALDE; p++)
+        {
+            niveis[fase - NIVEIS_FASE_MIN][balde][p] =
+                candidatos[inicio + (long)p * largura / NIVEIS_PADROES_POR_BALDE].padrao;
+        }
+    }
+    printf("Fase %2d (%dx%d): %d padroes unicos, dificuldade %.2f a %.2f\n",
+           fase, tamanho, tamanho, unicos, candidatos[0].dificuldade, candidatos[unicos - 1].dificuldade);
+    free(candidatos);
+}
+
+/**
+ * @brief Rotina de cada thread: pega a próxima fase da fila até acabar.
+ */
+void *trabalhar(void *argumento)
+{
+    (void)argumento;
+    int fase;
+    while ((fase = atomic_fetch_add(&proxima_fase, 1)) <= NIVEIS_FASE_MAX)
+    {
+        // Semente diferente e nunca zero para cada fase.
+        unsigned long long semente = (semente_base ^ (0x9E3779B97F4A7C15ULL * fase)) | 1;
+        calibrar_fase(fase, &semente);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Grava o cabeçalho e todos os padrões no formato de niveis.h.
+ *
+ * @param caminho Caminho do arquivo de saída
+ * @return 1 em caso de sucesso, 0 em caso de erro
+ */
+int gravar_niveis(const char *caminho)
+{
+    unsigned char cabecalho[NIVEIS_TAMANHO_CABECALHO];
+    FILE *arquivo = fopen(caminho, "wb");
+    if (arquivo == NULL)
+    {
+        return 0;
+    }
+
+    memcpy(cabecalho, NIVEIS_ASSINATURA, 4);
+    cabecalho[4] = NIVEIS_VERSAO;
+    cabecalho[5] = NIVEIS_FASE_MIN;
+    cabecalho[6] = NIVEIS_FASE_MAX;
+    cabecalho[7] = NIVEIS_BALDES;
+    cabecalho[8] = NIVEIS_PADROES_POR_BALDE & 0xFF;
+    cabecalho[9] = (NIVEIS_PADROES_POR_BALDE >> 8) & 0xFF;
+    fwrite(cabecalho, 1, sizeof(cabecalho), arquivo);
+
+    for (int f = 0; f < NIVEIS_QTD_FASES; f++)
+    {
+        for (int balde = 0; balde < NIVEIS_BALDES; balde++)
+        {
+            for (int p = 0; p < NIVEIS_PADROES_POR_BALDE; p++)
+            {
+                unsigned char bytes[8];
+                for (int b = 0; b < 8; b++)
+                {
+                    bytes[b] = (niveis[f][balde][p] >> (8 * b)) & 0xFF;
+                }
+                fwrite(bytes, 1, sizeof(bytes), arquivo);
+            }
+        }
+    }
+    int erro = ferror(arquivo);
+    return (fclose(arquivo) == 0 && !erro)? 1 : 0;
+}
@@ -27,6 +27,18 @@
  * - stdio.h para debug com printf.
  * - stdlib.h usando a função rand() para gerar números aleatórios.
  * - time.h usando a função time(NULL) para obter o tempo atual.
+ * - niveis.h com o formato do arquivo de níveis calibrados e definir_tamanho().
+ * - stdatomic.h para a fila de cliques sem trava (lock-free).
+ *
+ * @note ENTRADA_POR_CALLBACK:
+ * Com 0 (padrão), os cliques são lidos uma vez por quadro com
+ * IsMouseButtonPressed(), e vários cliques no mesmo quadro contam como um.
+ * Com 1 (-DENTRADA_POR_CALLBACK=1), os cliques são capturados por um callback
+ * do GLFW encadeado ao do raylib e chegam separados. Exige linkar com o raylib
+ * estático (libraylib.a), que inclui os símbolos do GLFW; o raylib
+ * compartilhado (.so/.dll) só exporta as funções RLAPI.
+ * Nos dois casos o instante do clique é o da consulta de eventos do quadro
+ * (glfwPollEvents), não o do clique físico.
  */
 
 #include <raylib.h>
@@ -34,6 +46,24 @@
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
+#include <stdatomic.h>
+#include "niveis.h"
+
+#ifndef ENTRADA_POR_CALLBACK
+#define ENTRADA_POR_CALLBACK 0
+#endif
+
+#if ENTRADA_POR_CALLBACK
+// Protótipos do GLFW (já incluído no raylib desktop) para não depender do glfw3.h.
+typedef struct GLFWwindow GLFWwindow;
+typedef void (*GLFWmousebuttonfun)(GLFWwindow *janela, int botao, int acao, int modificadores);
+GLFWmousebuttonfun glfwSetMouseButtonCallback(GLFWwindow *janela, GLFWmousebuttonfun callback);
+GLFWwindow *glfwGetCurrentContext(void);
+#define GLFW_PRESS 1
+#endif
+
+#define TAMANHO_DA_FILA 64 // Deve ser potência de 2.
+#define MAX_AMOSTRAS_DE_LATENCIA 4096
 
 /* ========================= Protótipos de Funções ========================= */
 
@@ -48,15 +78,26 @@ void fim_de_jogo();
 void mostrar_ranking();
 void aleatorizar_tabuleiro(int fase, int tamanho, int matriz[][tamanho]);
 void limpar_matriz(int tamanho, int matriz[][tamanho]);
-int definir_tamanho(int fase);
+void carregar_niveis(const char *caminho);
+int definir_balde(int fase);
+int sortear_nivel(int fase, int tamanho, int matriz[][tamanho]);
 void desenhar_gabarito(int celulas, int matriz[][celulas], int cordenada);
-void desenhar_interacao(int celulas, int prova[][celulas], int cordenada);
+void desenhar_interacao(int fase, int celulas, int prova[][celulas], int cordenada);
 void calcular_pontos(int fase, int celulas, int gabarito[][celulas], int prova[][celulas]);
 void desenhar_resultado(int celulas, int matriz[][celulas], int prova[][celulas], int cordenada);
 void desenhar_contador(int tempo_atual, int tempo_inicio);
 void esperar_tempo(int tempo_limite);
 void temporizador(int tempo, int *pt_inicio, int *pt_estado);
 void carregar_imagens();
+void iniciar_entrada();
+void capturar_entrada();
+void descartar_eventos();
+void registrar_latencias(double tempo_de_apresentacao);
+void marcar_consulta(double tempo_da_consulta);
+void relatorio_de_latencia();
+int comparar_latencias(const void *a, const void *b);
+void imprimir_percentis(const char *titulo, double amostras[]);
+void enfileirar_clique(int botao, double tempo, double espera);
 void execucao_do_jogo();
 
 /* =============================== Registros =============================== */
@@ -77,6 +118,45 @@ typedef struct registo_de_jogadores
     int fase;
 } registro;
 
+/**
+ * @brief Clique do mouse com o instante da consulta que o entregou.
+ *
+ * @param x Posição x do mouse no clique.
+ * @param y Posição y do mouse no clique.
+ * @param botao Botão pressionado (MOUSE_LEFT_BUTTON ou MOUSE_RIGHT_BUTTON).
+ * @param tempo Instante da consulta de eventos em segundos (relógio monotônico do GetTime()).
+ * @param espera Tempo desde a consulta anterior: o clique físico aconteceu
+ * no máximo esse tempo antes de "tempo".
+ *
+ * @note Cliques entregues na mesma consulta têm praticamente o mesmo "tempo".
+ */
+
+typedef struct evento_de_clique
+{
+    float x;
+    float y;
+    int botao;
+    double tempo;
+    double espera;
+} evento;
+
+/**
+ * @brief Fila circular sem trava de um produtor e um consumidor (SPSC).
+ *
+ * @note O produtor só escreve "fim" e o consumidor só escreve "inicio",
+ * então a fila continua correta se a captura for para outra thread.
+ */
+
+typedef struct fila_de_eventos
+{
+    evento eventos[TAMANHO_DA_FILA];
+    atomic_uint inicio;
+    atomic_uint fim;
+} fila;
+
+int enfileirar_evento(fila *f, evento e);
+int desenfileirar_evento(fila *f, evento *e);
+
 /* =========================== Variáveis Globais =========================== */
 
 registro jogador[4]; // Vetor de jogadores max = 4;
@@ -86,6 +166,21 @@ const int largura_da_tela = 500;
 const int altura_da_tela = 500;
 int cliques = 0;
 int estado_do_jogo = 0;
+unsigned long long niveis[NIVEIS_QTD_FASES][NIVEIS_BALDES][NIVEIS_PADROES_POR_BALDE]; // Padrões de niveis.bin.
+int niveis_carregados = 0;
+fila fila_de_cliques;
+unsigned int eventos_perdidos = 0; // Cliques descartados com a fila cheia.
+int aceitando_cliques = 0; // Só o tabuleiro, na fase de interação, recebe cliques na fila.
+double ultima_consulta = 0; // Instante da última consulta de eventos do tabuleiro.
+double consulta_anterior = 0;
+evento cliques_pendentes[TAMANHO_DA_FILA]; // Cliques aplicados e ainda não apresentados.
+int qtd_pendentes = 0;
+double latencias[MAX_AMOSTRAS_DE_LATENCIA]; // Latência consulta -> tela, em segundos.
+double latencias_maximas[MAX_AMOSTRAS_DE_LATENCIA]; // Limite superior clique -> tela.
+int qtd_latencias = 0;
+#if ENTRADA_POR_CALLBACK
+GLFWmousebuttonfun callback_do_raylib = NULL;
+#endif
 
 /* =========================== Função Principal ============================ */
 
@@ -93,6 +188,7 @@ int main()
 {
     // Inicialização da semente para geração de números aleatórios.
     srand(time(0));
+    carregar_niveis(NIVEIS_ARQUIVO);
     execucao_do_jogo();
     return 0;
 }
@@ -119,6 +215,8 @@ void execucao_do_jogo(){
     SetWindowIcon(icon);
     UnloadImage(icon);
 
+    iniciar_entrada();
+
     while(!WindowShouldClose()) {
         switch (estado_do_jogo) {
             case 0:
@@ -136,6 +234,7 @@ void execucao_do_jogo(){
                 break;
         }
     }
+    relatorio_de_latencia();
     CloseWindow();
     return;
 }
@@ -357,7 +456,10 @@ int tela_do_tabuleiro(int fase)
 
     limpar_matriz(celulas, matriz);
     limpar_matriz(celulas, matriz_do_jogador);
-    aleatorizar_tabuleiro(fase, celulas, matriz);
+    if (!sortear_nivel(fase, celulas, matriz))
+    {
+        aleatorizar_tabuleiro(fase, celulas, matriz);
+    }
 
     // Variaveis do temporizador
     int estado = 0;
@@ -365,8 +467,18 @@ int tela_do_tabuleiro(int fase)
     int *pt_tempoi = &tempo_inicial;
     int *pt_estado = &estado;
 
+    // Não herda o tempo de consulta de outra tela.
+    ultima_consulta = consulta_anterior = GetTime();
+
     while (!WindowShouldClose())
     {
+        capturar_entrada();
+        // Cliques fora da fase de interação não contam.
+        if (!(estado == 2 && cliques < fase))
+        {
+            descartar_eventos();
+        }
+
         BeginDrawing();
         ClearBackground(BLACK);
 
@@ -388,7 +500,7 @@ int tela_do_tabuleiro(int fase)
         {
             if (cliques < fase)
             {
-                desenhar_interacao(celulas, matriz_do_jogador, cordenada);
+                desenhar_interacao(fase, celulas, matriz_do_jogador, cordenada);
             }
             if (cliques == fase)
             {
@@ -407,8 +519,14 @@ int tela_do_tabuleiro(int fase)
             break;
         }
 
+        // Os cliques são entregues durante o EndDrawing().
+        aceitando_cliques = (estado == 2 && cliques < fase);
         EndDrawing();
+        double apresentacao = GetTime();
+        registrar_latencias(apresentacao);
+        marcar_consulta(apresentacao);
     }
+    aceitando_cliques = 0;
     return 0;
 }
 
@@ -441,18 +559,46 @@ void desenhar_gabarito(int celulas, int gabarito[][celulas], int cordenada)
 /**
  * @brief Desenha e gerencia a interação do jogador com o tabuleiro de jogo.
  *
- * Esta função renderiza os quadrados do tabuleiro, permitindo que o jogador
- * interaja através de cliques do mouse. Quadrados podem ser marcados com
- * clique esquerdo e desmarcados com clique direito.
+ * Esta função consome os cliques da fila de eventos e renderiza os quadrados
+ * do tabuleiro. Quadrados podem ser marcados com clique esquerdo e
+ * desmarcados com clique direito. Vários cliques no mesmo quadro são
+ * aplicados em ordem, até completar a quantidade da fase.
  *
+ * @param fase Quantidade de quadrados que o jogador deve marcar
  * @param celulas Número de células em cada dimensão do tabuleiro
  * @param prova Matriz 2D representando o estado de cliques do jogador
  * @param cordenada Coordenada inicial de desenho para posicionamento da matriz
  */
-void desenhar_interacao(int celulas, int prova[][celulas], int cordenada)
+void desenhar_interacao(int fase, int celulas, int prova[][celulas], int cordenada)
 {
-    int linha, coluna, x, y;
+    int x, y;
     int quadrado_tamanho = 50;
+    evento clique;
+
+    while (cliques < fase && qtd_pendentes < TAMANHO_DA_FILA && desenfileirar_evento(&fila_de_cliques, &clique))
+    {
+        // 51 = tamanho do quadrado (50) + espaco (1)
+        int dx = (int)clique.x - cordenada;
+        int dy = (int)clique.y - cordenada;
+        if (dx < 0 || dy < 0 || dx / 51 >= celulas || dy / 51 >= celulas)
+        {
+            continue;
+        }
+        int linha = dy / 51, coluna = dx / 51;
+
+        if (clique.botao == MOUSE_LEFT_BUTTON && prova[linha][coluna] == 0)
+        {
+            cliques++;
+            prova[linha][coluna] = 1;
+            cliques_pendentes[qtd_pendentes++] = clique;
+        }
+        else if (clique.botao == MOUSE_RIGHT_BUTTON && prova[linha][coluna] == 1)
+        {
+            cliques--;
+            prova[linha][coluna] = 0;
+            cliques_pendentes[qtd_pendentes++] = clique;
+        }
+    }
 
     for (int linha = 0; linha < celulas; linha++)
     {
@@ -466,32 +612,6 @@ void desenhar_interacao(int celulas, int prova[][celulas], int cordenada)
 
             x = cordenada + coluna * 51;
             y = cordenada + linha * 51;
-
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
-            {
-                if (GetMouseX() >= x && GetMouseX() <= x + quadrado_tamanho &&
-                        GetMouseY() >= y && GetMouseY() <= y + quadrado_tamanho)
-                {
-                    if (prova[linha][coluna] == 0)
-                    {
-                        cliques++;
-                        prova[linha][coluna] = 1;
-                    }
-                }
-            }
-            else if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
-            {
-                if (GetMouseX() >= x && GetMouseX() <= x + quadrado_tamanho &&
-                        GetMouseY() >= y && GetMouseY() <= y + quadrado_tamanho)
-                {
-                    if (prova[linha][coluna] == 1)
-                    {
-                        cliques--;
-                        prova[linha][coluna] = 0;
-                    }
-                }
-            }
-
             DrawRectangle(x, y, quadrado_tamanho, quadrado_tamanho, cor);
         }
     }
@@ -635,18 +755,123 @@ void aleatorizar_tabuleiro(int fase, int tamanho, int matriz[][tamanho])
 }
 
 /**
- * @brief Determina o tamanho do tabuleiro com base no número da fase.
+ * @brief Carrega os níveis calibrados gerados pelo avaliador de níveis.
+ *
+ * @param caminho Caminho do arquivo niveis.bin
+ *
+ * @note Se o arquivo não existir ou for de outro formato, o jogo continua
+ * usando aleatorizar_tabuleiro().
+ */
+void carregar_niveis(const char *caminho)
+{
+    unsigned char cabecalho[NIVEIS_TAMANHO_CABECALHO];
+    unsigned char bytes[8];
+    FILE *arquivo = fopen(caminho, "rb");
+    if (arquivo == NULL)
+    {
+        return;
+    }
+
+    if (fread(cabecalho, 1, sizeof(cabecalho), arquivo) != sizeof(cabecalho) ||
+            memcmp(cabecalho, NIVEIS_ASSINATURA, 4) != 0 ||
+            cabecalho[4] != NIVEIS_VERSAO || cabecalho[5] != NIVEIS_FASE_MIN ||
+            cabecalho[6] != NIVEIS_FASE_MAX || cabecalho[7] != NIVEIS_BALDES ||
+            (cabecalho[8] | (cabecalho[9] << 8)) != NIVEIS_PADROES_POR_BALDE)
+    {
+        printf("Arquivo de niveis invalido: %s\n", caminho);
+        fclose(arquivo);
+        return;
+    }
+
+    for (int f = 0; f < NIVEIS_QTD_FASES; f++)
+    {
+        for (int balde = 0; balde < NIVEIS_BALDES; balde++)
+        {
+            for (int p = 0; p < NIVEIS_PADROES_POR_BALDE; p++)
+            {
+                if (fread(bytes, 1, sizeof(bytes), arquivo) != sizeof(bytes))
+                {
+                    printf("Arquivo de niveis incompleto: %s\n", caminho);
+                    fclose(arquivo);
+                    return;
+                }
+                niveis[f][balde][p] = 0;
+                for (int b = 0; b < 8; b++)
+                {
+                    niveis[f][balde][p] |= (unsigned long long)bytes[b] << (8 * b);
+                }
+            }
+        }
+    }
+    fclose(arquivo);
+    niveis_carregados = 1;
+}
+
+/**
+ * @brief Escolhe o balde de dificuldade da fase.
  *
  * @param fase Número da fase atual do jogo
- * @return Tamanho do tabuleiro (4, 5 ou 6) dependendo do número da fase
+ * @return Índice do balde (0 = mais fácil)
  *
- * @note O tamanho do tabuleiro aumenta progressivamente com o avanço das fases
+ * @note A primeira fase de cada tamanho de tabuleiro usa o balde mais fácil
+ * e as seguintes vão ficando mais difíceis, suavizando o salto de tamanho.
  */
-int definir_tamanho(int fase)
+int definir_balde(int fase)
 {
-    int tamanho;
-    tamanho = (fase <= 5)? 4 : (fase <= 10)? 5 : 6;
-    return tamanho;
+    int primeira = fase, ultima = fase;
+    while (primeira > NIVEIS_FASE_MIN && definir_tamanho(primeira - 1) == definir_tamanho(fase))
+    {
+        primeira--;
+    }
+    while (ultima < NIVEIS_FASE_MAX && definir_tamanho(ultima + 1) == definir_tamanho(fase))
+    {
+        ultima++;
+    }
+    return (fase - primeira) * NIVEIS_BALDES / (ultima - primeira + 1);
+}
+
+/**
+ * @brief Preenche a matriz com um padrão sorteado dos níveis calibrados.
+ *
+ * @param fase Número da fase atual, que determina quantas células serão preenchidas
+ * @param tamanho Dimensão da matriz quadrada
+ * @param matriz Ponteiro para a matriz a ser preenchida
+ * @return 1 se usou um nível calibrado, 0 se não há nível para esta fase
+ *
+ * @note Confere se o padrão cabe no tabuleiro e tem "fase" quadrados antes de usar.
+ */
+int sortear_nivel(int fase, int tamanho, int matriz[][tamanho])
+{
+    unsigned long long padrao;
+    int total = tamanho * tamanho, quadrados = 0;
+
+    if (!niveis_carregados || fase < NIVEIS_FASE_MIN || fase > NIVEIS_FASE_MAX || total > 64)
+    {
+        return 0;
+    }
+    padrao = niveis[fase - NIVEIS_FASE_MIN][definir_balde(fase)][gerador_de_numeros(NIVEIS_PADROES_POR_BALDE)];
+
+    for (int celula = 0; celula < 64; celula++)
+    {
+        if (padrao & (1ULL << celula))
+        {
+            if (celula >= total)
+            {
+                return 0;
+            }
+            quadrados++;
+        }
+    }
+    if (quadrados != fase)
+    {
+        return 0;
+    }
+
+    for (int celula = 0; celula < total; celula++)
+    {
+        matriz[celula / tamanho][celula % tamanho] = (padrao >> celula) & 1;
+    }
+    return 1;
 }
 
 /**
@@ -689,3 +914,200 @@ void temporizador(int tempo, int *pt_tempoi, int *pt_estado)
         *pt_tempoi = time(NULL);
     }
 }
+
+/**
+ * @brief Coloca um evento na fila (lado do produtor).
+ *
+ * @return 1 se enfileirou, 0 se a fila estava cheia
+ */
+int enfileirar_evento(fila *f, evento e)
+{
+    unsigned int fim = atomic_load_explicit(&f->fim, memory_order_relaxed);
+    unsigned int inicio = atomic_load_explicit(&f->inicio, memory_order_acquire);
+    if (fim - inicio == TAMANHO_DA_FILA)
+    {
+        return 0;
+    }
+    f->eventos[fim & (TAMANHO_DA_FILA - 1)] = e;
+    atomic_store_explicit(&f->fim, fim + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ * @brief Retira o evento mais antigo da fila (lado do consumidor).
+ *
+ * @return 1 se retirou um evento, 0 se a fila estava vazia
+ */
+int desenfileirar_evento(fila *f, evento *e)
+{
+    unsigned int inicio = atomic_load_explicit(&f->inicio, memory_order_relaxed);
+    unsigned int fim = atomic_load_explicit(&f->fim, memory_order_acquire);
+    if (inicio == fim)
+    {
+        return 0;
+    }
+    *e = f->eventos[inicio & (TAMANHO_DA_FILA - 1)];
+    atomic_store_explicit(&f->inicio, inicio + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ * @brief Cria o evento de clique com a posição atual do mouse e o enfileira.
+ *
+ * @param botao Botão pressionado
+ * @param tempo Instante da consulta que entregou o clique
+ * @param espera Tempo desde a consulta anterior
+ *
+ * @note Fora da fase de interação do tabuleiro o clique é ignorado.
+ */
+void enfileirar_clique(int botao, double tempo, double espera)
+{
+    if (!aceitando_cliques)
+    {
+        return;
+    }
+    Vector2 mouse = GetMousePosition();
+    evento clique = {mouse.x, mouse.y, botao, tempo, espera};
+    if (!enfileirar_evento(&fila_de_cliques, clique))
+    {
+        eventos_perdidos++;
+    }
+}
+
+#if ENTRADA_POR_CALLBACK
+/**
+ * @brief Callback de botões do mouse chamado pelo GLFW a cada evento.
+ *
+ * @note Repassa o evento ao callback original do raylib, para que
+ * IsMouseButtonPressed() continue funcionando nas outras telas.
+ */
+void callback_de_clique(GLFWwindow *janela, int botao, int acao, int modificadores)
+{
+    if (callback_do_raylib != NULL)
+    {
+        callback_do_raylib(janela, botao, acao, modificadores);
+    }
+    if (acao == GLFW_PRESS && (botao == MOUSE_LEFT_BUTTON || botao == MOUSE_RIGHT_BUTTON))
+    {
+        // Dentro do EndDrawing(): ultima_consulta ainda é a do quadro anterior.
+        double agora = GetTime();
+        enfileirar_clique(botao, agora, agora - ultima_consulta);
+    }
+}
+#endif
+
+/**
+ * @brief Registra o callback de cliques. Deve ser chamada depois de InitWindow().
+ */
+void iniciar_entrada()
+{
+#if ENTRADA_POR_CALLBACK
+    // GetWindowHandle() só devolve a GLFWwindow no Linux (HWND no Windows, NSWindow no macOS).
+    callback_do_raylib = glfwSetMouseButtonCallback(glfwGetCurrentContext(), callback_de_clique);
+#endif
+}
+
+/**
+ * @brief Captura os cliques do quadro quando não há callback.
+ *
+ * @note Com o callback ativo os cliques já chegam pela fila e esta função não faz nada.
+ */
+void capturar_entrada()
+{
+#if !ENTRADA_POR_CALLBACK
+    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+    {
+        enfileirar_clique(MOUSE_LEFT_BUTTON, ultima_consulta, ultima_consulta - consulta_anterior);
+    }
+    if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
+    {
+        enfileirar_clique(MOUSE_RIGHT_BUTTON, ultima_consulta, ultima_consulta - consulta_anterior);
+    }
+#endif
+}
+
+/**
+ * @brief Esvazia a fila de cliques sem aplicá-los.
+ */
+void descartar_eventos()
+{
+    evento descartado;
+    while (desenfileirar_evento(&fila_de_cliques, &descartado));
+}
+
+/**
+ * @brief Guarda a latência dos cliques aplicados neste quadro.
+ *
+ * @param tempo_de_apresentacao Instante logo após o EndDrawing() (troca de buffers)
+ *
+ * @note Guarda duas medidas até a apresentação do quadro que mostra o resultado:
+ * - consulta -> tela: a partir da consulta que entregou o clique (limite inferior).
+ * - clique -> tela: somando a espera desde a consulta anterior (limite superior).
+ * O atraso do monitor não entra em nenhuma delas.
+ */
+void registrar_latencias(double tempo_de_apresentacao)
+{
+    for (int i = 0; i < qtd_pendentes; i++)
+    {
+        if (qtd_latencias < MAX_AMOSTRAS_DE_LATENCIA)
+        {
+            latencias[qtd_latencias] = tempo_de_apresentacao - cliques_pendentes[i].tempo;
+            latencias_maximas[qtd_latencias] = latencias[qtd_latencias] + cliques_pendentes[i].espera;
+            qtd_latencias++;
+        }
+    }
+    qtd_pendentes = 0;
+}
+
+/**
+ * @brief Guarda o instante da consulta de eventos feita no EndDrawing().
+ *
+ * @param tempo_da_consulta Instante logo após o EndDrawing()
+ */
+void marcar_consulta(double tempo_da_consulta)
+{
+    consulta_anterior = ultima_consulta;
+    ultima_consulta = tempo_da_consulta;
+}
+
+/**
+ * @brief Compara duas latências para o qsort().
+ */
+int comparar_latencias(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Mostra os percentis de um vetor de latências no terminal.
+ *
+ * @param titulo Nome da medida
+ * @param amostras Latências em segundos (são ordenadas aqui)
+ */
+void imprimir_percentis(const char *titulo, double amostras[])
+{
+    qsort(amostras, qtd_latencias, sizeof(double), comparar_latencias);
+    printf("%s: p50 %.2f ms | p90 %.2f ms | p99 %.2f ms | max %.2f ms\n", titulo,
+           amostras[qtd_latencias * 50 / 100] * 1000.0,
+           amostras[qtd_latencias * 90 / 100] * 1000.0,
+           amostras[qtd_latencias * 99 / 100] * 1000.0,
+           amostras[qtd_latencias - 1] * 1000.0);
+}
+
+/**
+ * @brief Mostra os percentis de latência de entrada no terminal.
+ *
+ * @note O instante real do clique não é conhecido: fica entre a consulta
+ * anterior e a que o entregou. Por isso são mostrados os dois limites.
+ */
+void relatorio_de_latencia()
+{
+    if (qtd_latencias == 0)
+    {
+        return;
+    }
+    printf("\nLatencia de entrada (%d cliques, %u perdidos na fila):\n", qtd_latencias, eventos_perdidos);
+    imprimir_percentis("consulta -> tela (minimo)", latencias);
+    imprimir_percentis("clique -> tela (maximo)", latencias_maximas);
+}
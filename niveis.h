@@ -0,0 +1,50 @@
+/* ======================== Documentação do Arquivo ======================== */
+/**
+ * @file niveis.h
+ * @brief Formato do arquivo de níveis calibrados (niveis.bin).
+ *
+ * @note Descrição:
+ * O arquivo é gerado pelo avaliador de níveis e lido pelo jogo na
+ * inicialização. Para cada fase existem NIVEIS_BALDES baldes de dificuldade
+ * (do mais fácil ao mais difícil), cada um com NIVEIS_PADROES_POR_BALDE padrões.
+ *
+ * Layout (little-endian):
+ * - 4 bytes: assinatura "JMNV".
+ * - 1 byte: versão, fase mínima, fase máxima e número de baldes.
+ * - 2 bytes: padrões por balde.
+ * - 8 bytes por padrão, na ordem fase -> balde -> padrão.
+ *
+ * Cada padrão é uma máscara de bits: o bit (linha * tamanho + coluna)
+ * ligado indica um quadrado azul no tabuleiro.
+ */
+
+#ifndef NIVEIS_H
+#define NIVEIS_H
+
+#define NIVEIS_ARQUIVO "niveis.bin"
+#define NIVEIS_ASSINATURA "JMNV"
+#define NIVEIS_VERSAO 1
+#define NIVEIS_FASE_MIN 3
+#define NIVEIS_FASE_MAX 20
+#define NIVEIS_BALDES 3
+#define NIVEIS_PADROES_POR_BALDE 64
+#define NIVEIS_TAMANHO_CABECALHO 10
+#define NIVEIS_QTD_FASES (NIVEIS_FASE_MAX - NIVEIS_FASE_MIN + 1)
+
+/**
+ * @brief Determina o tamanho do tabuleiro com base no número da fase.
+ *
+ * @param fase Número da fase atual do jogo
+ * @return Tamanho do tabuleiro (4, 5 ou 6) dependendo do número da fase
+ *
+ * @note O tamanho do tabuleiro aumenta progressivamente com o avanço das fases.
+ * Fica aqui para que o jogo e o avaliador de níveis usem a mesma regra.
+ */
+static int definir_tamanho(int fase)
+{
+    int tamanho;
+    tamanho = (fase <= 5)? 4 : (fase <= 10)? 5 : 6;
+    return tamanho;
+}
+
+#endif